@@ -13,6 +13,7 @@
 
 namespace stk {
 namespace mesh {
+class FieldBase;
 class Part;
 typedef std::vector<Part*> PartVector;
 }
@@ -44,6 +45,12 @@ public:
 
   virtual void pre_work() {}
 
+  // fields read and written by execute(); when provided, the realm may skip
+  // a property evaluation whose inputs and output are unchanged
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const { return false; }
+
   Realm &realm_;
   stk::mesh::PartVector partVec_;
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
@@ -31,6 +31,9 @@ public:
   virtual void execute();
   virtual void post_work(){};
 
+  // after the fields enqueued by the algorithms and post_work are communicated
+  virtual void post_comm_work(){};
+
   Realm &realm_;
   std::map<AlgorithmType, Algorithm *> algMap_;
 };
@@ -10,6 +10,7 @@
 #define AssembleContinuityEdgeSolverAlgorithm_h
 
 #include<SolverAlgorithm.h>
+#include<EdgeWorkset.h>
 #include<FieldTypeDef.h>
 
 namespace stk {
@@ -30,12 +31,14 @@ public:
   AssembleContinuityEdgeSolverAlgorithm(
     Realm &realm,
     stk::mesh::Part *part,
-    EquationSystem *eqSystem);
+    EquationSystem *eqSystem,
+    const bool fusedMdot = false);
   virtual ~AssembleContinuityEdgeSolverAlgorithm() {}
   virtual void initialize_connectivity();
   virtual void execute();
 
   const bool meshMotion_;
+  const bool fusedMdot_; /* save interior mdot and asq/axdx during assembly */
   
   VectorFieldType *velocityRTM_;
   VectorFieldType *Gpdx_;
@@ -43,6 +46,16 @@ public:
   ScalarFieldType *pressure_;
   ScalarFieldType *density_;
   VectorFieldType *edgeAreaVec_;
+  ScalarFieldType *massFlowRate_;
+  ScalarFieldType *mdotPressureCoeff_;
+
+  // SoA gather of nodal fields per edge bucket
+  EdgeWorkset edgeWorkset_;
+  int coordinatesSlot_;
+  int GpdxSlot_;
+  int velocityRTMSlot_;
+  int pressureSlot_;
+  int densitySlot_;
 };
 
 } // namespace nalu
@@ -10,6 +10,7 @@
 #define AssembleMomentumEdgeSolverAlgorithm_h
 
 #include<SolverAlgorithm.h>
+#include<EdgeWorkset.h>
 #include<FieldTypeDef.h>
 
 namespace sierra{
@@ -45,6 +46,15 @@ public:
   ScalarFieldType *viscosity_;
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *massFlowRate_;
+
+  // SoA gather of nodal fields per edge bucket
+  EdgeWorkset edgeWorkset_;
+  int coordinatesSlot_;
+  int dudxSlot_;
+  int velocityRTMSlot_;
+  int velocitySlot_;
+  int densitySlot_;
+  int viscositySlot_;
 };
 
 } // namespace nalu
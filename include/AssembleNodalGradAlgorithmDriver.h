@@ -29,6 +29,7 @@ public:
 
   void pre_work();
   void post_work();
+  void post_comm_work();
 
   const std::string scalarQName_;
   const std::string dqdxName_;
@@ -27,6 +27,7 @@ public:
 
   virtual void pre_work();
   virtual void post_work();
+  virtual void post_comm_work();
 
   const std::string dudxName_;
 };
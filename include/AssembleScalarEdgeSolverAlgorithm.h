@@ -10,6 +10,7 @@
 #define AssembleScalarEdgeSolverAlgorithm_h
 
 #include<SolverAlgorithm.h>
+#include<EdgeWorkset.h>
 #include<FieldTypeDef.h>
 
 namespace stk {
@@ -54,6 +55,14 @@ public:
   ScalarFieldType *massFlowRate_;
   VectorFieldType *edgeAreaVec_;
 
+  // SoA gather of nodal fields per edge bucket
+  EdgeWorkset edgeWorkset_;
+  int coordinatesSlot_;
+  int dqdxSlot_;
+  int velocityRTMSlot_;
+  int scalarQSlot_;
+  int densitySlot_;
+  int diffFluxCoeffSlot_;
 };
 
 } // namespace nalu
@@ -20,6 +20,9 @@ public:
       endPos_(endPos) {}
   virtual ~AuxFunction() {}
 
+  // true when the values depend on neither time nor anything but coords
+  virtual bool is_time_invariant() const { return false; }
+
   // coords:
   //    coordinates at each point, (x,y) for 2d, (x,y,z) for 3d
   // time:
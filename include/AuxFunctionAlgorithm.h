@@ -42,6 +42,13 @@ public:
   virtual ~AuxFunctionAlgorithm();
   virtual void execute();
 
+  // values depend on the coordinates only
+  bool is_time_invariant() const;
+
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const;
+
 private:
   stk::mesh::FieldBase * field_;
   AuxFunction *auxFunction_;
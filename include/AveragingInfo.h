@@ -25,14 +25,21 @@ public:
   ~AveragingInfo();
   
   void load(const YAML::Node & node);
+
+  // add to the Reynolds list unless already present
+  void add_reynolds_field(const std::string &fieldName);
   
   double currentTimeFilter_; /* providd by restart */
   double timeFilterInterval_; /* user supplied */
   bool forcedReset_; /* allows forhard reset */
   bool processAveraging_;
+  int sampleFrequency_; /* average every Nth time step */
+  double unsampledTime_; /* time since the last sample */
+  bool computeResolvedStress_; /* Reynolds velocity covariance */
   
   std::vector<std::string> favreFieldNameVec_;
   std::vector<std::string> reynoldsFieldNameVec_;
+  std::vector<std::string> varianceFieldNameVec_;
   
 };
 
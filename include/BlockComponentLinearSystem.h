@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef BlockComponentLinearSystem_h
+#define BlockComponentLinearSystem_h
+
+#include <LinearSystem.h>
+
+#include <vector>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// BlockComponentLinearSystem
+//=============================================================================
+/**
+ * * @par Description:
+ * - single-dof view of one component of a multi-dof block system. Scalar
+ *   assembly algorithms sum into it unchanged; each contribution lands in
+ *   the rows and columns of the chosen component of the block.
+ *
+ * @par Design Considerations:
+ * - graph construction and dirichlet conditions are forwarded to the block
+ *   system; zeroing, load complete and the solve belong to the owner of the
+ *   block, which calls sync_statistics() after each solve so that residual
+ *   norms and iteration counts remain available through this view.
+ */
+//=============================================================================
+class BlockComponentLinearSystem : public LinearSystem
+{
+public:
+
+  BlockComponentLinearSystem(
+    Realm &realm,
+    const std::string & name,
+    LinearSystem *blockSystem,
+    const unsigned component);
+  virtual ~BlockComponentLinearSystem() {}
+
+  // Graph/Matrix Construction
+  void buildNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildReducedElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeHaloNodeGraph(const stk::mesh::PartVector & parts);
+  void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts);
+  void finalizeLinearSystem() {}
+
+  // Matrix Assembly; zeroed by the owner of the block
+  void zeroSystem() {}
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve; done by the owner of the block
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete() {}
+  void storeRhs(const unsigned column, const unsigned numColumns);
+  int solveStoredRhs();
+  void loadStoredSolution(const unsigned column, stk::mesh::FieldBase * linearSolutionField);
+
+  void writeToFile(const char * filename, bool useOwned=true);
+  void writeSolutionToFile(const char * filename, bool useOwned=true);
+
+  // copy residuals and iteration count of the last block solve
+  void sync_statistics();
+
+  LinearSystem *blockSystem_;
+  const unsigned component_;
+
+private:
+  void beginLinearSystemConstruction() {}
+  void checkError(
+    const int err_code,
+    const char * msg);
+
+  // expanded block contributions
+  std::vector<double> blockRhs_;
+  std::vector<double> blockLhs_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -26,6 +26,7 @@ public:
 
   void pre_work();
   void post_work();
+  void post_comm_work();
   
 };
   
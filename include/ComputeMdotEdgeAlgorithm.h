@@ -10,6 +10,7 @@
 #define ComputeMdotEdgeAlgorithm_h
 
 #include<Algorithm.h>
+#include<EdgeWorkset.h>
 #include<FieldTypeDef.h>
 
 // stk
@@ -26,12 +27,18 @@ public:
 
   ComputeMdotEdgeAlgorithm(
     Realm &realm,
-    stk::mesh::Part *part);
+    stk::mesh::Part *part,
+    const bool fusedMdot = false);
   ~ComputeMdotEdgeAlgorithm();
 
   void execute();
+
+  // mdot saved by the fused continuity assembly; correct by pTmp only
+  void correct_assembled_mdot();
   
   const bool meshMotion_;
+  const bool fusedMdot_;
+  bool useAssembledMdot_;
   VectorFieldType *velocityRTM_;
   VectorFieldType *Gpdx_;
   VectorFieldType *coordinates_;
@@ -39,7 +46,16 @@ public:
   ScalarFieldType *density_;
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *massFlowRate_;
+  ScalarFieldType *pTmp_;
+  ScalarFieldType *mdotPressureCoeff_;
 
+  // SoA gather of nodal fields per edge bucket
+  EdgeWorkset edgeWorkset_;
+  int coordinatesSlot_;
+  int GpdxSlot_;
+  int velocityRTMSlot_;
+  int pressureSlot_;
+  int densitySlot_;
 };
 
 } // namespace nalu
@@ -0,0 +1,108 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ComputeWallDistanceAlgorithm_h
+#define ComputeWallDistanceAlgorithm_h
+
+#include<Algorithm.h>
+#include<FieldTypeDef.h>
+
+#include <vector>
+#include <cstddef>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// ComputeWallDistanceAlgorithm
+//=============================================================================
+/**
+ * * @par Description:
+ * - exact distance from every node to the nearest wall face. partVec_ holds
+ *   the wall parts; the result is written to minimum_distance_to_wall.
+ *
+ * @par Design Considerations:
+ * - wall faces are split into segments (2D) or triangles (3D) over their
+ *   vertices and the local sets are allgathered, so every rank holds the
+ *   full wall and no node communication is needed.
+ * - nearest-face queries descend a bounding volume hierarchy, nearer child
+ *   first, pruning on the box distance; each query is seeded with the
+ *   primitive found for the previous node of the bucket.
+ * - with verification active, the result is compared to a brute-force
+ *   search over all wall primitives and both timings are reported.
+ */
+//=============================================================================
+class ComputeWallDistanceAlgorithm : public Algorithm
+{
+public:
+  ComputeWallDistanceAlgorithm(
+    Realm &realm,
+    stk::mesh::PartVector &wallPartVec,
+    const bool verify);
+  virtual ~ComputeWallDistanceAlgorithm() {}
+
+  virtual void execute();
+
+  VectorFieldType *coordinates_;
+  ScalarFieldType *minDistanceToWall_;
+  const bool verify_;
+
+  // number of global wall primitives at the last execute
+  size_t numPrimitives_;
+
+ private:
+
+  // local wall primitives, nDim points of nDim coordinates each
+  void gather_local_primitives(
+    std::vector<double> &prims) const;
+
+  void build_tree();
+
+  // squared distance from pt to primitive p
+  double distance_sq(
+    const double *pt,
+    const size_t p) const;
+
+  // squared distance from pt to the bounding box of tree node n
+  double box_distance_sq(
+    const double *pt,
+    const size_t n) const;
+
+  // nearest primitive; seed is a starting guess
+  size_t nearest(
+    const double *pt,
+    const size_t seed,
+    double &distSq,
+    std::vector<size_t> &stack) const;
+
+  int nDim_;
+
+  // global primitives and their centroids
+  std::vector<double> prims_;
+  std::vector<double> centroids_;
+
+  // primitive indices in leaf order
+  std::vector<size_t> perm_;
+
+  // nodes in pre-order; children always follow their parent
+  std::vector<double> nodeMin_;
+  std::vector<double> nodeMax_;
+  std::vector<int> nodeLeft_;
+  std::vector<int> nodeRight_;
+  std::vector<size_t> nodeBegin_;
+  std::vector<size_t> nodeEnd_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -38,6 +38,14 @@ public:
       const double &up, const double &yp,
       const double &density, const double &viscosity,
       double &utau);
+
+  // masked Newton solve of the log law at n bips; utau holds the previous
+  // values on input, used as the starting point where they are positive
+  void compute_utau_batch(
+      const size_t n,
+      const double *up, const double *yp,
+      const double *density, const double *viscosity,
+      double *utau);
   
   void normalize_nodal_fields();
 
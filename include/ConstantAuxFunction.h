@@ -26,6 +26,8 @@ public:
     const std::vector<double> & values);
 
   virtual ~ConstantAuxFunction() {}
+
+  virtual bool is_time_invariant() const { return true; }
   
   virtual void do_evaluate(
     const double * coords,
@@ -14,6 +14,7 @@
 namespace stk {
 namespace mesh {
 struct Entity;
+class Bucket;
 }
 }
 
@@ -30,6 +31,11 @@ class ConstantPropertyEvaluator : public PropertyEvaluator
   double execute(double *indVarList,
                  stk::mesh::Entity node);
 
+  void execute_bucket(const stk::mesh::Bucket &b,
+                      const double * const * indVars,
+                      const size_t numIndVars,
+                      double *result);
+
   double value_;
 
 };
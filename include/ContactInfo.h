@@ -36,6 +36,7 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
+class SearchTree;
 class HaloInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
@@ -109,6 +110,10 @@ class ContactInfo {
 
   stk::search::SearchMethod searchMethod_;
 
+  /* persistent BVH; refit after mesh motion (search_method: persistent_bvh);
+     persistent_bvh_compare also times boost_rtree and stk_octree */
+  SearchTree *searchTree_;
+
   /* clip isoparametric coordinates if they are out of bounds */
   const bool clipIsoParametricCoords_;
 
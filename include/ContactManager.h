@@ -45,7 +45,8 @@ class ContactManager {
 
   // constructor and destructor
   ContactManager(
-    Realm & realm);
+    Realm & realm,
+    const bool differentialGhosting);
 
   ~ContactManager();
 
@@ -60,6 +61,9 @@ class ContactManager {
   uint64_t needToGhostCount_;
   bool provideDetailedOutput_;
 
+  /* add/remove only the change in ghosting */
+  const bool differentialGhosting_;
+
   stk::mesh::EntityProcVec elemsToGhost_;
   std::vector<ContactInfo *> contactInfoVec_;
 
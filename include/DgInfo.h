@@ -91,14 +91,51 @@ class DgInfo {
   // master element for opposing face connected element
   MasterElement *meSCSOpposing_;
 
-  // coordinates of gauss points on current face
-  std::vector<double> currentGaussPointCoords_;
+  // coordinates of gauss points on current face; first nDim used
+  double currentGaussPointCoords_[3];
 
   // iso-parametric coordinates for gauss point on current face (-1:1)
-  std::vector<double> currentIsoParCoords_;
+  double currentIsoParCoords_[3];
 
   // iso-parametric coordinates for gauss point on opposing face (-1:1)
-  std::vector<double> opposingIsoParCoords_;  
+  double opposingIsoParCoords_[3];
+};
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// DgInfoPool
+//=============================================================================
+/**
+ * * @par Description:
+ * - contiguous arena for DgInfo objects; storage is retained over clear()
+ *   so that repeated searches do not reallocate. Use as
+ *   new (pool.allocate()) DgInfo(...). Pointers are stable until clear().
+ */
+//=============================================================================
+class DgInfoPool {
+
+ public:
+
+  DgInfoPool();
+  ~DgInfoPool();
+
+  // storage for one more DgInfo
+  void *allocate();
+
+  // destroy all DgInfo objects; chunks are kept
+  void clear();
+
+  size_t size() const { return size_; }
+
+ private:
+
+  DgInfoPool(const DgInfoPool &);
+  DgInfoPool &operator=(const DgInfoPool &);
+
+  const size_t chunkSize_;
+  size_t size_;
+  std::vector<DgInfo *> chunks_;
 };
   
 } // end sierra namespace
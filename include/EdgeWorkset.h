@@ -0,0 +1,99 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EdgeWorkset_h
+#define EdgeWorkset_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Bucket.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/*
+  EdgeWorkset gathers a set of nodal fields for the left and right nodes
+  of every edge in an edge bucket into contiguous structure-of-arrays
+  storage. Edge algorithms register the fields they need once (constructor)
+  and, for each bucket, call gather() followed by a flux loop over the
+  contiguous arrays. Component i of edge k for a registered field slot is
+  located at [i*length()+k] of left(slot)/right(slot). Field data is read
+  through node bucket pointers, resolved once per bucket, and indexed by
+  bucket ordinal.
+*/
+
+class EdgeWorkset
+{
+public:
+
+  EdgeWorkset();
+  ~EdgeWorkset();
+
+  // register a nodal field of fieldSize components; returns slot
+  int add_field(
+    const stk::mesh::FieldBase *field,
+    const int fieldSize);
+
+  // gather all registered fields for the edges of bucket b
+  void gather(
+    const stk::mesh::Bucket &b);
+
+  size_t length() const { return length_; }
+
+  const double *left(const int slot) const { return dataL_[slot].data(); }
+  const double *right(const int slot) const { return dataR_[slot].data(); }
+
+  stk::mesh::Entity node_left(const size_t k) const { return nodeL_[k]; }
+  stk::mesh::Entity node_right(const size_t k) const { return nodeR_[k]; }
+
+  // scratch space of size length() for per-edge fluxes
+  double *scratch(const int slot);
+
+private:
+
+  size_t length_;
+  size_t capacity_;
+
+  std::vector<const stk::mesh::FieldBase *> fields_;
+  std::vector<int> fieldSize_;
+
+  std::vector<std::vector<double> > dataL_;
+  std::vector<std::vector<double> > dataR_;
+  std::vector<std::vector<double> > scratch_;
+
+  std::vector<stk::mesh::Entity> nodeL_;
+  std::vector<stk::mesh::Entity> nodeR_;
+
+  // node bucket and bucket ordinal of each edge node
+  std::vector<const stk::mesh::Bucket *> bucketL_;
+  std::vector<const stk::mesh::Bucket *> bucketR_;
+  std::vector<unsigned> ordinalL_;
+  std::vector<unsigned> ordinalR_;
+
+  // per field, data pointer of each node bucket by bucket id; resolved once
+  // per gather, since state rotation swaps the pointers without a mesh change
+  std::vector<std::vector<const double *> > bucketData_;
+  std::vector<std::vector<size_t> > bucketStamp_;
+  size_t numGathers_;
+
+  const double *bucket_data(
+    const size_t f,
+    const stk::mesh::Bucket &nodeBucket);
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
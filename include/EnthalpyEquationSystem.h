@@ -82,6 +82,7 @@ public:
   void post_iter_work();
   void post_adapt_work();
   void extract_temperature();
+  void dump_eq_time();
   void post_converged_work();
   void initial_work();
   
@@ -114,6 +115,10 @@ public:
   bool lowSpeedCompressActive_;
   bool isInit_;
 
+  // temperature extraction; iterations per node, bin zero for not converged
+  const int maxTemperatureIterations_;
+  std::vector<size_t> temperatureIterHistogram_;
+
   std::vector<TemperaturePropAlgorithm *> enthalpyFromTemperatureAlg_;
   std::vector<Algorithm *> bdf2CopyStateAlg_;
 
@@ -43,9 +43,21 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
+
+  bool mixture_enthalpy_coefficients(
+      const stk::mesh::Bucket &b,
+      double *lowCoeffs,
+      double *highCoeffs,
+      double &TlowHigh) const;
   
   std::vector<double> refMassFraction_;
   
@@ -68,10 +80,25 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
 
+  bool mixture_enthalpy_coefficients(
+      const stk::mesh::Bucket &b,
+      double *lowCoeffs,
+      double *highCoeffs,
+      double &TlowHigh) const;
+
   // field definition and extraction
   GenericFieldType *massFraction_;
   
@@ -112,6 +139,9 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
+
   // field definition and extraction
   const double referenceTemperature_;
   const size_t cpVecSize_;
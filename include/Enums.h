@@ -193,6 +193,19 @@ const std::string NonConformalAlgTypeNames[] = {
   "rb",
   "END" };
 
+enum MeshReorderType {
+  MESH_REORDER_NONE = 0,
+  MESH_REORDER_HILBERT = 1,
+  MESH_REORDER_RCM = 2,
+  MESH_REORDER_TYPE_END = 3
+};
+
+const std::string MeshReorderTypeNames[] = {
+  "none",
+  "hilbert",
+  "rcm",
+  "END" };
+
 } // namespace nalu
 } // namespace Sierra
 
@@ -69,6 +69,9 @@ public:
   // Solve
   int solve(stk::mesh::FieldBase * linearSolutionField);
   void loadComplete();
+  void storeRhs(const unsigned column, const unsigned numColumns);
+  int solveStoredRhs();
+  void loadStoredSolution(const unsigned column, stk::mesh::FieldBase * linearSolutionField);
   void writeToFile(const char * filename, bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
 
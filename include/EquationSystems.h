@@ -118,7 +118,8 @@ public:
   double provide_mean_system_norm();
 
   void predict_state();
-  void populate_boundary_data();
+  void populate_boundary_data(
+    const bool fillTimeInvariant);
   void boundary_data_to_state_data();
   void provide_output();
   void dump_eq_time();
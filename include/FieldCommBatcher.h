@@ -0,0 +1,136 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef FieldCommBatcher_h
+#define FieldCommBatcher_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+// stk
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
+#include <utility>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class AlgorithmDriver;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// FieldCommBatcher
+//=============================================================================
+/**
+ * * @par Description:
+ * - realm-level batcher for parallel field communication over shared
+ *   entities. Algorithms enqueue (field, operation) pairs; flush() hands
+ *   every enqueued field of one operation to a single stk parallel call,
+ *   i.e., one message per neighbouring rank and operation.
+ * - an algorithm driver is a sync point: AlgorithmDriver::execute() calls
+ *   complete(), which flushes and then runs the driver's post_comm_work().
+ *   Algorithms whose result is only read after their driver enqueue and
+ *   leave the flush to the driver; those that read the communicated values
+ *   themselves still flush().
+ * - between begin_deferral() and end_deferral(), complete() only records
+ *   the driver; drivers that do not read each other's results (e.g., the
+ *   k and omega nodal gradients) then share one flush at end_deferral().
+ *   Any flush() in between also completes the recorded drivers, in order.
+ *
+ * @par Design Considerations:
+ * - every rank must enqueue the same fields in the same order.
+ * - a (field, operation) pair is queued once; summing a field twice in one
+ *   flush would add the neighbours' contribution twice.
+ * - with report_field_communication on, message count and bytes are
+ *   accumulated and reported once per step; the shared entity lists used
+ *   for the count are rebuilt only when the mesh is modified.
+ */
+//=============================================================================
+class FieldCommBatcher {
+
+ public:
+
+  enum CommOp {
+    COMM_SUM = 0,
+    COMM_MAX = 1,
+    COMM_COPY_OWNED_TO_SHARED = 2
+  };
+
+  FieldCommBatcher(
+    Realm &realm);
+
+  ~FieldCommBatcher();
+
+  void enqueue(
+    stk::mesh::FieldBase *field,
+    const CommOp op);
+
+  void enqueue(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const CommOp op);
+
+  // communicate everything enqueued so far and empty the queue; then run
+  // post_comm_work() of drivers completed under a deferral
+  void flush();
+
+  // driver-level sync point, see above
+  void complete(
+    AlgorithmDriver *driver);
+
+  // nested; the outermost end flushes
+  void begin_deferral();
+  void end_deferral();
+
+  // write (optionally) and reset the per-step counters
+  void end_step(
+    const bool doOutput);
+
+  Realm &realm_;
+
+  // per-step diagnostics; local to this rank
+  size_t numFlushes_;
+  size_t numMessages_;
+  size_t numBytes_;
+
+ private:
+
+  FieldCommBatcher(const FieldCommBatcher &);
+  FieldCommBatcher &operator=(const FieldCommBatcher &);
+
+  void update_shared_entities();
+
+  void count_traffic();
+
+  std::vector<stk::mesh::FieldBase *> fieldQueue_;
+  std::vector<CommOp> opQueue_;
+
+  // drivers waiting for the next flush
+  std::vector<AlgorithmDriver *> pendingDrivers_;
+  int deferralDepth_;
+
+  // (proc, entity) pairs per entity rank
+  std::vector<std::vector<std::pair<int, stk::mesh::Entity> > > sharedEntities_;
+  size_t sharedSyncCount_;
+  bool sharedValid_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
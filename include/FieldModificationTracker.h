@@ -0,0 +1,118 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef FieldModificationTracker_h
+#define FieldModificationTracker_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <map>
+#include <cstddef>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// FieldModificationTracker
+//=============================================================================
+/**
+ * * @par Description:
+ * - per-field modification counters for a set of tracked fields. Each
+ *   write stamps the field with the next value of a realm-wide counter, so
+ *   a consumer that remembers the stamp of its last evaluation can tell
+ *   whether any of its inputs changed since.
+ *
+ * @par Design Considerations:
+ * - writers report their writes; nothing is inspected. The realm marks the
+ *   fields written by equation system updates, boundary data, transfers,
+ *   state rotation, restart and geometry updates.
+ * - equation systems do not enumerate the fields they write, so every
+ *   update marks all tracked fields flagged as solve-written. Fields whose
+ *   writers all report explicitly (coordinates, volumes, property outputs)
+ *   are not flagged.
+ * - writing any state of a field marks all of its tracked states.
+ * - after a mesh modification every tracked field is considered changed.
+ * - decisions are rank-local; consumers must not communicate.
+ */
+//=============================================================================
+class FieldModificationTracker {
+
+ public:
+
+  FieldModificationTracker(
+    Realm &realm);
+
+  ~FieldModificationTracker();
+
+  // start tracking; solve-written fields change with every equation system update
+  void track(
+    stk::mesh::FieldBase *field,
+    const bool solveWritten);
+
+  // stamp a field (all tracked states) that was just written
+  void mark_modified(
+    stk::mesh::FieldBase *field);
+
+  // stamp every solve-written field
+  void mark_solve_modified();
+
+  // stamp every tracked field
+  void mark_all_modified();
+
+  // stamp everything when the mesh was modified since the last call
+  void update();
+
+  // latest stamp issued
+  size_t stamp() const { return stamp_; }
+
+  // stamp of the last detected change; zero for untracked fields
+  size_t last_modified(
+    stk::mesh::FieldBase *field) const;
+
+  // number of detected changes
+  size_t modification_count(
+    stk::mesh::FieldBase *field) const;
+
+  Realm &realm_;
+
+ private:
+
+  FieldModificationTracker(const FieldModificationTracker &);
+  FieldModificationTracker &operator=(const FieldModificationTracker &);
+
+  struct Record {
+    bool solveWritten_;
+    size_t lastModified_;
+    size_t count_;
+    Record() : solveWritten_(false), lastModified_(0), count_(0) {}
+  };
+
+  void bump(
+    Record &record);
+
+  std::map<stk::mesh::FieldBase *, Record> records_;
+  size_t stamp_;
+  size_t syncCount_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,46 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+#ifndef GhostingFunctions_h
+#define GhostingFunctions_h
+
+#include <stk_mesh/base/Types.hpp>
+
+#include <stdint.h>
+
+namespace stk{
+namespace mesh{
+class BulkData;
+class Ghosting;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/* 
+   Differential ghosting update: elemsToGhost is the desired (element, proc)
+   send list on this process. It is compared with the elements currently
+   sent by the ghosting; only new sends are added and, when removeStale is
+   set, sends no longer requested are removed (the removal keys are shipped
+   to the receiving processes). The modification cycle is skipped when no
+   process has a difference. Returns the global number of changes.
+
+   removeStale must only be set when elemsToGhost is the complete send list,
+   i.e., after a full search.
+*/
+
+uint64_t change_ghosting_differential(
+  stk::mesh::BulkData & bulkData,
+  stk::mesh::Ghosting & ghosting,
+  stk::mesh::EntityProcVec & elemsToGhost,
+  const bool removeStale);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -9,6 +9,7 @@
 #include <map>
 
 #include <tabular_props/HDF5Table.h>
+#include <tabular_props/BSpline.h>
 
 namespace stk {
 namespace mesh {
@@ -53,7 +54,10 @@ public:
     std::string tablePropName,
     std::vector<std::string> &indVarNameVec,
     std::vector<std::string> &indVarTableNameVec,
-    const stk::mesh::MetaData &meta_data);
+    const stk::mesh::MetaData &meta_data,
+    const double gridTolerance = 0.0,
+    const bool gridCubic = false,
+    const size_t gridMaxPoints = 0);
 
   virtual ~HDF5TablePropAlgorithm();
 
@@ -63,12 +67,18 @@ public:
   const size_t indVarSize_;
 
   std::vector<stk::mesh::FieldBase *> indVar_;
-  std::vector<double *> workIndVar_;
-  std::vector<double> workZ_;
+  std::vector<const double *> workIndVar_;
+
+  // scratch space for bucket-wide table queries
+  BSplineBatch batchWork_;
 
   /** execute Algorithm */
   virtual void execute();
 
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const;
+
   /** Get the name of the variable returned by a query to this HDF5TablePropAlgorithm */
   const std::string & name() const { return tablePropName_; }
 
@@ -38,6 +38,12 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
   
   const double pRef_;
   const double R_;
@@ -59,6 +65,15 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
   
   double compute_mw(
       const double *yk);
@@ -90,6 +105,15 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(pressure_); }
+
   // reference quantities
   const double R_;
 
@@ -116,6 +140,15 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
   
   double compute_mw(
       const double *yk);
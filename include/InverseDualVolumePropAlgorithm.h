@@ -36,6 +36,10 @@ public:
   virtual ~InverseDualVolumePropAlgorithm();
   
   virtual void execute();
+
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const;
   
   stk::mesh::FieldBase *prop_;
   ScalarFieldType *dualNodalVolume_;
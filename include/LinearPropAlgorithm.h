@@ -39,6 +39,10 @@ public:
 
   virtual void execute();
 
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const;
+
   stk::mesh::FieldBase *prop_;
   stk::mesh::FieldBase *indVar_;
   const double primary_;
@@ -44,6 +44,8 @@ typedef Teuchos::ScalarTraits<Scalar> STS;
 
 #include <MueLu_UseShortNames.hpp>    // => typedef MueLu::FooClass<Scalar, LocalOrdinal, ...> Foo
 
+#include <vector>
+
 class Epetra_FECrsMatrix;
 class Epetra_Vector;
 class Epetra_FEVector;
@@ -169,6 +171,13 @@ class TpetraLinearSolver : public LinearSolver
       int & iterationCount,
       double & scaledResidual);
 
+    // one preconditioner setup for all columns of rhs
+    int solve_multiple(
+      Teuchos::RCP<LinSys::MultiVector> sln,
+      Teuchos::RCP<LinSys::MultiVector> rhs,
+      int & iterationCount,
+      std::vector<double> & residualNorms);
+
     virtual PetraType getType() { return PT_TPETRA; }
     TpetraLinearSolverConfig *getConfig() { return config_; }
 
@@ -81,6 +81,12 @@ public:
   virtual int solve(stk::mesh::FieldBase * linearSolutionField)=0;
   virtual void loadComplete()=0;
 
+  // Multiple right-hand sides sharing one operator; store the assembled
+  // rhs as a column, solve all columns at once, then extract each column
+  virtual void storeRhs(const unsigned column, const unsigned numColumns)=0;
+  virtual int solveStoredRhs()=0;
+  virtual void loadStoredSolution(const unsigned column, stk::mesh::FieldBase * linearSolutionField)=0;
+
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
   const unsigned numDof() const { return numDof_; }
@@ -90,6 +96,9 @@ public:
   const double & scaledNonLinearResidual() {return scaledNonLinearResidual_; }
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  bool & assembleRhsOnly() {return assembleRhsOnly_;}
+  double & spmvTime() {return timerSpmv_;}
+  int & spmvCount() {return numSpmv_;}
 protected:
   virtual void beginLinearSystemConstruction()=0;
   virtual void checkError(
@@ -113,6 +122,9 @@ protected:
   double scaledNonLinearResidual_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool assembleRhsOnly_; // lhs from the previous assembly is kept
+  double timerSpmv_; // matrix-vector product probe; see Realm::reportSpmvTiming_
+  int numSpmv_;
 
 public:
   bool provideOutput_;
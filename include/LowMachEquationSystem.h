@@ -26,6 +26,7 @@ class AssembleNodalGradAlgorithmDriver;
 class AssembleNodalGradUAlgorithmDriver;
 class MomentumEquationSystem;
 class ContinuityEquationSystem;
+class ComputeMdotEdgeAlgorithm;
 class LinearSystem;
 class SurfaceForceAndMomentAlgorithmDriver;
 
@@ -35,7 +36,8 @@ public:
 
   LowMachEquationSystem (
     EquationSystems& equationSystems,
-    const bool elementContinuityEqs);
+    const bool elementContinuityEqs,
+    const bool fusedMdotContinuity);
   virtual ~LowMachEquationSystem();
   
   virtual void initialize();
@@ -177,7 +179,8 @@ public:
 
   ContinuityEquationSystem(
     EquationSystems& equationSystems,
-    const bool elementContinuityEqs);
+    const bool elementContinuityEqs,
+    const bool fusedMdot);
   virtual ~ContinuityEquationSystem();
 
   virtual void register_nodal_fields(
@@ -229,17 +232,24 @@ public:
       stk::mesh::Part *part,
       const std::map<std::string, std::string> &theNames,
       const std::map<std::string, std::vector<double> > &theParams);
+
+  // mdot; after a solve, fused mode corrects the assembled mdot by pTmp
+  void compute_mdot(
+    const bool afterSolve);
   
   const bool elementContinuityEqs_;
+  const bool fusedMdot_; /* edge mdot saved during continuity assembly */
   ScalarFieldType *pressure_;
   VectorFieldType *dpdx_;
   ScalarFieldType *massFlowRate_;
   VectorFieldType *coordinates_;
 
   ScalarFieldType *pTmp_;
+  ScalarFieldType *mdotPressureCoeff_;
 
   AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
   AlgorithmDriver *computeMdotAlgDriver_;
+  ComputeMdotEdgeAlgorithm *computeMdotEdgeAlg_;
 };
 
 } // namespace nalu
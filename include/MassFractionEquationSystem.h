@@ -35,7 +35,8 @@ public:
 
   MassFractionEquationSystem(
       EquationSystems& equationSystems,
-      const int numMassFraction);
+      const int numMassFraction,
+      const bool multipleRhsSolve);
   virtual ~MassFractionEquationSystem();
   
   void register_nodal_fields(
@@ -89,11 +90,18 @@ public:
   void solve_and_update();
   void compute_nth_mass_fraction();
 
+  // one lhs per nonlinear iteration; all species rhs solved together
+  void assemble_and_solve_multiple_rhs(
+    double &nonLinearResidualSum,
+    double &linearResidualSum,
+    double &linearIterationsSum);
+
   bool system_is_converged();
   double provide_scaled_norm();
   double provide_norm();
   
   const int numMassFraction_;
+  const bool multipleRhsSolve_;
   
   GenericFieldType *massFraction_;
   ScalarFieldType *currentMassFraction_;
@@ -38,6 +38,11 @@ public:
   std::string tablePropName_;
   std::string tableAuxVarName_;
 
+  // optional uniform-grid resampling of the table; off when tolerance is zero
+  double tableGridTolerance_;
+  bool tableGridCubic_;
+  size_t tableGridMaxPoints_;
+
   // vectors and maps
   std::map<std::string, std::vector<double> > polynomialCoeffsMap_;
   std::map<std::string, std::vector<double> > lowPolynomialCoeffsMap_;
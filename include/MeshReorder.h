@@ -0,0 +1,114 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MeshReorder_h
+#define MeshReorder_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <Enums.h>
+#include <FieldTypeDef.h>
+
+// stk
+#include <stk_mesh/base/Entity.hpp>
+
+#include <vector>
+#include <stdint.h>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/*
+  MeshReorder computes a cache-aware ordering of the local nodes, either
+  along a Hilbert space-filling curve or by reverse Cuthill-McKee on the
+  node graph. The ordering is stored as a per-rank key in the nodal field
+  nalu_reorder_key. The linear system orders its owned and globally owned
+  rows by this key rather than by naluGlobalId; naluGlobalId itself is
+  untouched so that periodic and parallel consistency is preserved.
+
+  This is a matrix row ordering only. Node, edge and element storage (and
+  so the traversal order of the assembly loops) is left as stk creates it:
+  the nodes come from the mesh file, the edges from stk::mesh::create_edges,
+  and bucket contents cannot be permuted from here. The effect on the
+  matrix-vector product is measured with the realm option
+  report_spmv_timing, run once with and once without mesh_reordering;
+  execute() reports the mean graph span and the mean row jump of the
+  assembly loops under both orderings.
+
+  Keys are per rank and cover the nodes present at execute(), which is
+  rerun after every modification that changes node ownership (refinement,
+  adaptivity). Only owned rows follow the key. Nodes owned elsewhere,
+  including those ghosted later by periodic or non-conformal search,
+  carry no valid key here and keep naluGlobalId order.
+*/
+
+class MeshReorder {
+
+ public:
+
+  MeshReorder(
+    Realm & realm,
+    const MeshReorderType reorderType);
+
+  ~MeshReorder();
+
+  // declare nalu_reorder_key; before commit
+  void setup();
+
+  // compute the ordering; after field data is populated (and after adapt)
+  void execute();
+
+  Realm &realm_;
+  const MeshReorderType reorderType_;
+  LocalIdFieldType *reorderKey_;
+
+ private:
+
+  // fill nodes in their native (naluGlobalId) order
+  void gather_nodes(
+    std::vector<stk::mesh::Entity> &nodes);
+
+  // CSR node graph from edges (or element connectivity)
+  void build_node_graph(
+    const std::vector<stk::mesh::Entity> &nodes,
+    std::vector<size_t> &offsets,
+    std::vector<size_t> &adjacency);
+
+  // order[i] is the native index of the i-th node in the new ordering
+  void hilbert_order(
+    const std::vector<stk::mesh::Entity> &nodes,
+    std::vector<size_t> &order);
+
+  void rcm_order(
+    const std::vector<size_t> &offsets,
+    const std::vector<size_t> &adjacency,
+    std::vector<size_t> &order);
+
+  double mean_span(
+    const std::vector<size_t> &offsets,
+    const std::vector<size_t> &adjacency,
+    const std::vector<size_t> &position);
+
+  // mean row jump between consecutive entities of the assembly loops
+  double mean_assembly_stride(
+    const std::vector<size_t> &position);
+
+  uint64_t hilbert_key(
+    const uint32_t *x,
+    const int nDim,
+    const int nBits);
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
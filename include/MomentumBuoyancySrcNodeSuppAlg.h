@@ -42,6 +42,13 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual void bucket_execute(
+    const int &lhsSize,
+    const int &rhsSize,
+    double *lhs,
+    double *rhs,
+    stk::mesh::Bucket &b);
+
   ScalarFieldType *densityNp1_;
   ScalarFieldType *dualNodalVolume_;
   int nDim_;
@@ -14,6 +14,7 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <DgInfo.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -36,7 +37,7 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class DgInfo;
+class SearchTree;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -74,13 +75,24 @@ class NonConformalInfo {
   ~NonConformalInfo();
 
   void initialize();
+  void incremental_initialize();
   void construct_dgInfo_state();
+  void update_current_gauss_point_coords();
+  void search_cached_opposing_faces();
   void find_possible_face_elements();
   void set_best_x();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
 
+  // isInElement on a candidate face; keeps the face if it is the best so far
+  void evaluate_opposing_face(
+    DgInfo *dgInfo,
+    stk::mesh::Entity opposingFace,
+    const int opposingFaceIsGhosted,
+    std::vector<double> &faceNodalCoords,
+    std::vector<double> &opposingIsoParCoords);
+
   Realm &realm_;
   const std::string name_;
 
@@ -93,6 +105,10 @@ class NonConformalInfo {
 
   stk::search::SearchMethod searchMethod_;
 
+  /* persistent BVH; refit after mesh motion (search_method: persistent_bvh);
+     persistent_bvh_compare also times boost_rtree and stk_octree */
+  SearchTree *searchTree_;
+
   /* clip isoparametric coordinates if they are out of bounds */
   const bool clipIsoParametricCoords_;
 
@@ -112,8 +128,12 @@ class NonConformalInfo {
   std::vector<boundingPoint>      boundingPointVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
 
-  /* vector of DgInfo */
+  /* vector of DgInfo; objects live in dgInfoPool_ */
   std::vector<std::vector<DgInfo *> > dgInfoVec_;
+  DgInfoPool dgInfoPool_;
+
+  /* DgInfo that require the coarse search; all of them unless incremental */
+  std::vector<DgInfo *> searchDgInfoVec_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
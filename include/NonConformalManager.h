@@ -47,16 +47,30 @@ class NonConformalManager {
   // constructor and destructor
   NonConformalManager(
     Realm & realm,
-    const bool ncAlgDetailedOutput );
+    const bool ncAlgDetailedOutput,
+    const bool ncAlgIncrementalSearch,
+    const bool differentialGhosting );
 
   ~NonConformalManager();
 
   void initialize();
   void manage_ghosting();
 
+  // drop received ghosts that no local Gauss point references
+  void prune_ghosting();
+
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
 
+  /* reuse the previous opposing faces when the topology is unchanged */
+  const bool ncAlgIncrementalSearch_;
+  size_t syncCount_;
+
+  /* add/remove only the change in ghosting; an incremental search only adds,
+     and unreferenced ghosts are pruned by the receiver afterwards */
+  const bool differentialGhosting_;
+  bool pruneGhosting_;
+
   /* ghosting for all surface:block pair */
   stk::mesh::Ghosting *nonConformalGhosting_;
 
@@ -26,6 +26,8 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <string>
+#include <stdint.h>
 
 namespace sierra {
 namespace nalu {
@@ -43,7 +45,8 @@ class PeriodicManager {
 
   // constructor and destructor
   PeriodicManager(
-    Realm & realm);
+    Realm & realm,
+    const std::string &pairingCacheName = "");
 
   ~PeriodicManager();
 
@@ -63,11 +66,23 @@ class PeriodicManager {
     const bool &addSlaves = true,
     const bool &setSlaves = true);
 
+  // master += slave; slave = master for a set of fields with one communication per phase
+  void apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true);
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
     const unsigned &sizeOfField);
 
+  void apply_max_field(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec);
+
   void create_ghosting_object();
 
   stk::mesh::Ghosting * get_ghosting_object();
@@ -98,17 +113,30 @@ class PeriodicManager {
 
   void error_check();
 
+  /* hash of the decomposition and, per master/slave pair, the owned node ids/coordinates of each side */
+  uint64_t compute_pairing_hash();
+
+  /* restore searchKeyVector_ from a previous run; true only if every rank succeeds */
+  bool read_pairing_cache(
+    const uint64_t pairingHash);
+
+  void write_pairing_cache(
+    const uint64_t pairingHash);
+
   void update_global_id_field();
 
   /* communicate periodicGhosting nodes */
   void
   periodic_parallel_communicate_field(
-    stk::mesh::FieldBase *theField);
+    const std::vector<stk::mesh::FieldBase *> &theFieldVec);
 
   /* communicate shared nodes and aura nodes */
   void
   parallel_communicate_field(
-    stk::mesh::FieldBase *theField);
+    const std::vector<stk::mesh::FieldBase *> &theFieldVec);
+
+  /* refresh master/slave bucket locations after mesh modification */
+  void update_index_arrays();
 
   Realm &realm_;
   double searchTolerance_;
@@ -117,6 +145,9 @@ class PeriodicManager {
   const std::string ghostingName_;
   double timerSearch_;
 
+  // optional per-rank file set holding the master/slave pairs
+  const std::string pairingCacheName_;
+
   // the data structures to hold master/slave information
   typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> EntityPair;
   typedef std::pair<stk::mesh::Selector, stk::mesh::Selector> SelectorPair;
@@ -125,7 +156,8 @@ class PeriodicManager {
   // vector of master:slave selector pairs
   std::vector<SelectorPair> periodicSelectorPairs_;
 
-  // vector of slave parts
+  // vector of master and slave parts, one of each per user pair
+  stk::mesh::PartVector masterPartVector_;
   stk::mesh::PartVector slavePartVector_;
 
   // vector of search types
@@ -138,6 +170,13 @@ class PeriodicManager {
   // vector of masterEntity:slaveEntity
   std::vector<EntityPair> masterSlaveCommunicator_;
 
+  // contiguous bucket locations of masterSlaveCommunicator_
+  size_t indexSyncCount_;
+  std::vector<stk::mesh::Bucket *> masterBucket_;
+  std::vector<stk::mesh::Bucket *> slaveBucket_;
+  std::vector<unsigned> masterOrdinal_;
+  std::vector<unsigned> slaveOrdinal_;
+
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
@@ -42,6 +42,24 @@ public:
       double *indVarList,
       stk::mesh::Entity node) = 0;
   
+  // mass-fraction weighted, R/mw scaled h coefficients (six per range)
+  // of one node, written with the given stride
+  void mixture_coefficients(
+      const double *yk,
+      double *lowCoeffs,
+      double *highCoeffs,
+      const size_t stride) const;
+
+  // mixture h (or cp when evaluating the derivative) at length nodes;
+  // ykStride is zero for a single composition shared by all nodes
+  void evaluate_mixture(
+      const size_t length,
+      const double *yk,
+      const size_t ykStride,
+      const double *T,
+      const bool derivative,
+      double *result) const;
+
   const double universalR_;
   const size_t ykVecSize_;
   const double TlowHigh_;
@@ -13,6 +13,13 @@
 
 #include <vector>
 
+namespace stk {
+namespace mesh {
+class Bucket;
+class FieldBase;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
@@ -26,6 +33,29 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
+
+  // evaluate at every node of bucket b; indVars[i] holds the b.size()
+  // values of independent variable i and result receives b.size() values.
+  // The default adapter calls execute() node by node
+  virtual void execute_bucket(
+    const stk::mesh::Bucket &b,
+    const double * const * indVars,
+    const size_t numIndVars,
+    double *result);
+
+  // fields read through the node argument of execute(), if any
+  virtual void input_fields(
+    std::vector<stk::mesh::FieldBase *> &fields) const {}
+
+  // batched temperature inversion support: for the nodes of bucket b,
+  // h = T*(c0 + c1*T/2 + c2*T^2/3 + c3*T^3/4 + c4*T^4/5) + c5 and
+  // cp = dh/dT, with coefficients stored [j*length + k] for each range;
+  // false when this evaluator is not a polynomial enthalpy
+  virtual bool mixture_enthalpy_coefficients(
+    const stk::mesh::Bucket &b,
+    double *lowCoeffs,
+    double *highCoeffs,
+    double &TlowHigh) const { return false; }
   
 };
 
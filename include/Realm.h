@@ -22,6 +22,7 @@
 #include <Teuchos_RCP.hpp>
 
 #include <stk_util/util/ParameterList.hpp>
+#include <stk_util/parallel/Parallel.hpp>
 
 // standard c++
 #include <map>
@@ -66,6 +67,9 @@ class Simulation;
 class SolutionOptions;
 class TimeIntegrator;
 class MasterElement;
+class MeshReorder;
+class FieldCommBatcher;
+class FieldModificationTracker;
 class PropertyEvaluator;
 class HDF5FilePtr;
 class Transfer;
@@ -111,6 +115,13 @@ public:
     const std::string name, double &value, const bool useDefault);
   void pre_timestep_work();
   void evaluate_properties();
+
+  // report field writes to lazy property evaluation; no-ops otherwise
+  void mark_field_modified(
+    stk::mesh::FieldBase *field);
+  void mark_solve_fields_modified();
+  void mark_all_fields_modified();
+
   void augment_property_map(
     PropertyIdentifier propID,
     ScalarFieldType *theField);
@@ -158,6 +169,7 @@ public:
   void initialize_non_conformal();
 
   void compute_geometry();
+  void rotate_geometry();
   void compute_vrtm();
   void compute_l2_scaling();
   void advance_time_step();
@@ -216,6 +228,12 @@ public:
     const unsigned &sizeOfTheField,
     const bool &bypassFieldCheck = true) const;
 
+  // batched; one periodic/parallel communication round per phase for all fields
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool &bypassFieldCheck = true) const;
+
   void periodic_delta_solution_update(
      stk::mesh::FieldBase *theField,
      const unsigned &sizeOfTheField) const;
@@ -310,6 +328,11 @@ public:
 
   Realms& realms_;
 
+  // communicator of the mesh; a sub-communicator when realms advance
+  // concurrently, in which case the realm is only loaded where it is active
+  stk::ParallelMachine realmComm_;
+  bool activeOnRank_;
+
   std::string inputDBName_;
   unsigned spatialDimension_;
 
@@ -385,6 +408,12 @@ public:
   double timerAdapt_;
   double timerTransferSearch_;
 
+  // time at which edge/exposed area vectors were last brought up to date
+  double geometryTime_;
+
+  // time of the mesh motion that placed the current coordinates
+  double coordinatesTime_;
+
   ContactManager *contactManager_;
   NonConformalManager *nonConformalManager_;
   bool hasContact_;
@@ -393,6 +422,28 @@ public:
 
   PeriodicManager *periodicManager_;
   bool hasPeriodic_;
+  std::string periodicPairingCacheName_;
+
+  // optional cache-aware ordering of linear system rows
+  MeshReorder *meshReorder_;
+
+  // time matrix-vector products after each load complete; compares row orderings
+  bool reportSpmvTiming_;
+
+  // batched shared-entity field communication
+  FieldCommBatcher *fieldCommBatcher_;
+  bool reportFieldComm_;
+
+  // skip property algorithms whose declared inputs did not change
+  bool lazyPropertyEvaluation_;
+  FieldModificationTracker *fieldModTracker_;
+  std::vector<size_t> propertyEvalStamp_;
+  size_t numPropertyEvals_;
+  size_t numPropertySkips_;
+
+  // time-invariant boundary data is filled once per mesh
+  bool boundaryDataFilled_;
+  size_t boundaryDataSyncCount_;
 
   // global parameter list
   stk::util::ParameterList globalParameters_;
@@ -16,6 +16,8 @@
 #include <Realm.h>
 #include <NaluParsing.h>
 
+#include <stk_util/parallel/Parallel.hpp>
+
 #include <map>
 #include <string>
 #include <algorithm>
@@ -34,11 +36,17 @@ class Simulation;
 
 class Realms : public RealmVector {
 public:
-  Realms(Simulation& sim) : simulation_(sim) {}
+  Realms(Simulation& sim)
+    : simulation_(sim),
+      concurrent_(false),
+      splitComm_(MPI_COMM_NULL),
+      realmColor_(-1) {}
 
   ~Realms();
 
   void load(const YAML::Node & node) ;
+  void split_communicator(const YAML::Node & realms);
+  int root_rank(const Realm *realm) const;
   void breadboard();
   void initialize();
   Simulation *root();
@@ -62,6 +70,13 @@ public:
 
   Simulation &simulation_;
 
+  // concurrent realms; the world communicator is split in contiguous rank
+  // ranges sized by realm node count, one range per realm
+  bool concurrent_;
+  stk::ParallelMachine splitComm_;
+  int realmColor_;
+  std::vector<int> realmRankBegin_;
+
 };
 
 } // namespace nalu
@@ -43,6 +43,13 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual void bucket_execute(
+    const int &lhsSize,
+    const int &rhsSize,
+    double *lhs,
+    double *rhs,
+    stk::mesh::Bucket &b);
+
   ScalarFieldType *scalarQN_;
   ScalarFieldType *scalarQNp1_;
   ScalarFieldType *densityN_;
@@ -0,0 +1,146 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef SearchTree_h
+#define SearchTree_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+// stk
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
+#include <stk_search/SearchMethod.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdint.h>
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// SearchTree
+//=============================================================================
+/**
+ * * @par Description:
+ * - persistent bounding volume hierarchy over the locally owned search
+ *   boxes. Once built, the tree is refit bottom-up in O(n) as long as the
+ *   box idents arrive in the same order (mesh motion only); otherwise it
+ *   is rebuilt.
+ *
+ * @par Design Considerations:
+ * - coarse_search is a drop-in for stk::search::coarse_search. On-rank
+ *   pairs come from the tree. Only points and boxes that overlap another
+ *   rank's extent (exchanged with one allgather) go through the parallel
+ *   stk search, using the residual method.
+ * - with comparison active, every search is repeated with the stk
+ *   boost_rtree and octree methods on the same input; their timings and
+ *   any difference in the resulting pairs are reported.
+ */
+//=============================================================================
+class SearchTree {
+
+ public:
+
+  typedef stk::search::IdentProc<uint64_t,int> theKey;
+  typedef stk::search::Point<double> Point;
+  typedef stk::search::Box<double> Box;
+  typedef std::pair<Point,theKey> boundingPoint;
+  typedef std::pair<Box,theKey> boundingElementBox;
+
+  // constructor and destructor
+  SearchTree(
+    const int nDim,
+    const stk::search::SearchMethod residualSearchMethod,
+    stk::ParallelMachine comm,
+    const bool compareMethods = false);
+
+  ~SearchTree();
+
+  void coarse_search(
+    const std::vector<boundingPoint> &points,
+    const std::vector<boundingElementBox> &boxes,
+    std::vector<std::pair<theKey, theKey> > &searchKeyPair);
+
+  // counts and timing for the timer summary; collective
+  void report(
+    const std::string &name) const;
+
+  const int nDim_;
+  const stk::search::SearchMethod residualSearchMethod_;
+  stk::ParallelMachine comm_;
+  const bool compareMethods_;
+
+  // diagnostics
+  size_t numSearches_;
+  size_t numBuilds_;
+  size_t numRefits_;
+  double searchTime_;
+
+  // stk boost_rtree and octree on the same searches
+  double rtreeTime_;
+  double octreeTime_;
+  size_t numMismatches_;
+
+ private:
+
+  void tree_search(
+    const std::vector<boundingPoint> &points,
+    const std::vector<boundingElementBox> &boxes,
+    std::vector<std::pair<theKey, theKey> > &searchKeyPair);
+
+  // repeat the search with an stk method; returns true when the pairs agree
+  bool compare_search(
+    const std::vector<boundingPoint> &points,
+    const std::vector<boundingElementBox> &boxes,
+    const std::vector<std::pair<theKey, theKey> > &searchKeyPair,
+    const stk::search::SearchMethod method,
+    double &time) const;
+
+  void build(
+    const std::vector<boundingElementBox> &boxes);
+
+  void refit(
+    const std::vector<boundingElementBox> &boxes);
+
+  // bounds from the node's boxes or, for an interior refit, its children
+  void fit_node(
+    const size_t node,
+    const std::vector<boundingElementBox> &boxes,
+    const bool fromBoxes);
+
+  void query(
+    const Point &pt,
+    const std::vector<boundingElementBox> &boxes,
+    std::vector<size_t> &hits) const;
+
+  // ident sequence of the boxes the tree was built for
+  std::vector<uint64_t> boxIds_;
+
+  // box indices in leaf order
+  std::vector<size_t> perm_;
+
+  // nodes in pre-order; children always follow their parent
+  std::vector<double> nodeMin_;
+  std::vector<double> nodeMax_;
+  std::vector<int> nodeLeft_;
+  std::vector<int> nodeRight_;
+  std::vector<size_t> nodeBegin_;
+  std::vector<size_t> nodeEnd_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -25,6 +25,11 @@ namespace nalu{
 
 class EquationSystems;
 class AlgorithmDriver;
+class BlockComponentLinearSystem;
+class ComputeWallDistanceAlgorithm;
+class LinearSystem;
+class SpecificDissipationRateSSTNodeSourceSuppAlg;
+class TurbKineticEnergySSTNodeSourceSuppAlg;
 class TurbKineticEnergyEquationSystem;
 class SpecificDissipationRateEquationSystem;
 
@@ -51,7 +56,14 @@ public:
 
   virtual void solve_and_update();
   void post_adapt_work();
+  virtual void reinitialize_linear_system();
 
+  // coupled k-omega solve; one two-dof system per node
+  void setup_block_system();
+  void assemble_and_solve_block();
+  void assemble_block_coupling();
+
+  void compute_wall_distance();
   void clip_min_distance_to_wall();
   void compute_f_one_blending();
   void update_and_clip();
@@ -64,12 +76,24 @@ public:
   ScalarFieldType *minDistanceToWall_;
   ScalarFieldType *fOneBlending_;
   ScalarFieldType *maxLengthScale_;
+  GenericFieldType *blockDelta_;
 
   bool isInit_;
   AlgorithmDriver *sstMaxLengthScaleAlgDriver_;
+  ComputeWallDistanceAlgorithm *wallDistanceAlg_;
+
+  // block system; tke and sdr assemble through component views of it
+  LinearSystem *blockLinsys_;
+  BlockComponentLinearSystem *tkeBlockComponent_;
+  BlockComponentLinearSystem *sdrBlockComponent_;
+  TurbKineticEnergySSTNodeSourceSuppAlg *tkeSrcJacobian_;
+  SpecificDissipationRateSSTNodeSourceSuppAlg *sdrSrcJacobian_;
 
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part *> wallBcPart_;
+
+  // saved of interior mesh parts; source cross terms live here
+  std::vector<stk::mesh::Part *> interiorPart_;
      
 };
 
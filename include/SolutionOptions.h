@@ -81,6 +81,12 @@ public:
   NonConformalAlgType ncAlgType_;
   bool ncAlgUpwindAdvection_;
   bool ncAlgDetailedOutput_;
+  bool ncAlgIncrementalSearch_;
+  bool differentialGhosting_;
+  bool rigidMotionGeometry_;
+  bool computeWallDistance_;
+  bool verifyWallDistance_;
+  bool sstBlockSolve_;
   bool cvfemShiftMdot_;
   bool cvfemShiftPoisson_;
   bool cvfemReducedSensPoisson_;
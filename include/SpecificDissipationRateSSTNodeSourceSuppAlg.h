@@ -40,6 +40,11 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node);
+
+  // omega-row, k-column source jacobian times the dual volume
+  void cross_jacobian_bucket(
+    stk::mesh::Bucket &b,
+    double *lhsWK);
   
   const double sigmaWTwo_, betaStar_, betaOne_, betaTwo_, gammaOne_, gammaTwo_;
   ScalarFieldType *sdrNp1_;
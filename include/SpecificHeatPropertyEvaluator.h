@@ -42,6 +42,12 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
   
   double compute_cp_r(
       const double &T,
@@ -68,6 +74,15 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
+
   double compute_cp_r(
       const double &T,
       const double *pt_poly);
@@ -91,6 +106,9 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
+
   // field definition and extraction
   const size_t cpVecSize_;
   GenericFieldType *massFraction_;
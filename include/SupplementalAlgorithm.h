@@ -13,7 +13,7 @@
 
 #include <stk_mesh/base/Types.hpp>
 
-namespace stk { namespace mesh { struct Entity; } }
+namespace stk { namespace mesh { struct Entity; class Bucket; } }
 
 namespace sierra{
 namespace nalu{
@@ -42,6 +42,15 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node) = 0;
+
+  // all nodes of a bucket at once; node k contributes to lhs[k*lhsSize]
+  // and rhs[k*rhsSize]. The default falls back to node_execute
+  virtual void bucket_execute(
+    const int &lhsSize,
+    const int &rhsSize,
+    double *lhs,
+    double *rhs,
+    stk::mesh::Bucket &b);
   
   Realm &realm_;
   
@@ -40,6 +40,12 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
   
   double compute_viscosity(
       const double &T,
@@ -64,6 +70,15 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
+  void input_fields(
+      std::vector<stk::mesh::FieldBase *> &fields) const { fields.push_back(massFraction_); }
+
   virtual double compute_viscosity(
       const double &T,
       const double *pt_poly);
@@ -92,6 +107,12 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void execute_bucket(
+      const stk::mesh::Bucket &b,
+      const double * const * indVars,
+      const size_t numIndVars,
+      double *result);
+
   const double tRef_;
 };
 
@@ -42,6 +42,10 @@ public:
 
   virtual void execute();
 
+  virtual bool property_dependencies(
+    std::vector<stk::mesh::FieldBase *> &inputs,
+    stk::mesh::FieldBase *&output) const;
+
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
   stk::mesh::FieldBase *temperature_;
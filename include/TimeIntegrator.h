@@ -39,6 +39,7 @@ public:
   Simulation *parent();
 
   void integrate_realm();
+  void process_transfers();
   void provide_mean_norm();
   bool simulation_proceeds();
   Simulation& sim_;
@@ -58,12 +59,19 @@ public:
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
 
+  // realms advance at once on disjoint sub-communicators; transfers are
+  // the synchronization points
+  bool concurrentRealms_;
+
   std::string name_;
 
   std::vector<std::string> realmNamesVec_;
 
   std::vector<Realm*> realmVec_;
 
+  // realms advanced by this process; a single one when realms are concurrent
+  std::vector<Realm*> activeRealmVec_;
+
   double get_time_step(
     const NaluState &theState = NALU_STATE_N);
   double get_current_time();
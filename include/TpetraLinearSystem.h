@@ -81,6 +81,9 @@ public:
   // Solve
   int solve(stk::mesh::FieldBase * linearSolutionField);
   void loadComplete();
+  void storeRhs(const unsigned column, const unsigned numColumns);
+  int solveStoredRhs();
+  void loadStoredSolution(const unsigned column, stk::mesh::FieldBase * linearSolutionField);
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
@@ -147,6 +150,13 @@ private:
   Teuchos::RCP<LinSys::Vector> sln_;
   Teuchos::RCP<LinSys::Vector> globalSln_;
   Teuchos::RCP<LinSys::Export> exporter_;
+
+  // stored right-hand sides and their solutions; one column per rhs
+  Teuchos::RCP<LinSys::MultiVector> multiRhs_;
+  Teuchos::RCP<LinSys::MultiVector> multiSln_;
+  std::vector<double> multiRhsNorm_;
+  std::vector<double> multiLinearResidual_;
+  int multiSolveIterations_;
   Teuchos::RCP<LinSys::Import> importer_;
 
   MyLIDMapType myLIDs_;
@@ -40,6 +40,18 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node);
+
+  virtual void bucket_execute(
+    const int &lhsSize,
+    const int &rhsSize,
+    double *lhs,
+    double *rhs,
+    stk::mesh::Bucket &b);
+
+  // k-row, omega-column source jacobian times the dual volume
+  void cross_jacobian_bucket(
+    stk::mesh::Bucket &b,
+    double *lhsKW);
   
   const double betaStar_;
   ScalarFieldType *tkeNp1_;
@@ -13,6 +13,7 @@
 #include <FieldTypeDef.h>
 
 // c++
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -38,12 +39,29 @@ public:
 
   virtual ~TurbulenceAveragingAlgorithm() {}
   virtual void execute();
+
+  // index of the Reynolds pair whose primitive is named primitiveName
+  size_t reynolds_index(
+    const std::string &primitiveName) const;
   
   std::vector<std::pair<stk::mesh::FieldBase *, stk::mesh::FieldBase *> > favreFieldVecPair_;
   std::vector<std::pair<stk::mesh::FieldBase *, stk::mesh::FieldBase *> > reynoldsFieldVecPair_;
   std::vector<unsigned> favreFieldSize_;
   std::vector<unsigned> reynoldsFieldSize_;
 
+  // variance fields and the Reynolds pair holding their primitive and mean
+  std::vector<stk::mesh::FieldBase *> varianceField_;
+  std::vector<size_t> varianceReynoldsIndex_;
+
+  // resolved stress, xx, yy, (zz,) xy, (xz, yz); NULL when not requested
+  stk::mesh::FieldBase *resolvedStress_;
+  size_t velocityReynoldsIndex_;
+
+  // bucket workspace
+  std::vector<double> ws_oldRhoRA;
+  std::vector<double> ws_favreOld;
+  std::vector<double> ws_favreNew;
+
 };
 
 } // namespace nalu
@@ -8,6 +8,32 @@ namespace nalu {
 
 // Forward declarations
 class H5IO;
+class BSpline1D;
+
+/**
+ *  @struct BSplineBatch
+ *  @brief  Caller-owned scratch space for BSpline::value_batch().
+ *
+ *  Holds the parametric coordinate, knot span and basis functions of every
+ *  point in every dimension, stored dimension-major so that the loops over
+ *  points are contiguous.  The spline itself is never written to, so
+ *  concurrent batch evaluations are safe as long as each has its own
+ *  BSplineBatch.  The arrays grow to the largest batch seen and are reused.
+ */
+struct BSplineBatch {
+  int n_;                      // number of points in the current batch
+  int stride_;                 // (max order + 1); basis functions per point and dimension
+  std::vector<double> u_;      // parametric coordinate, [d*n + k]
+  std::vector<int> span_;      // knot span index, [d*n + k]
+  std::vector<double> basis_;  // basis functions, [(d*stride + j)*n + k]
+
+  // table input staging used by HDF5Table::query_batch(), [d*n + k]
+  std::vector<double> input_;
+  std::vector<double> checked_;
+  std::vector<int> clipped_;
+
+  BSplineBatch() : n_(0), stride_(0) {}
+};
 
 //====================================================================
 //====================================================================
@@ -55,6 +81,28 @@ class BSpline{
 
   double value( std::vector<double> & x ) const{ return value( &x[0] ); }
 
+  /**
+   *  Evaluate the dependent variable at n points.  indepVars[d] points to
+   *  the n values of the d-th independent variable.  Knot spans and basis
+   *  functions are computed once per point and dimension and shared by all
+   *  of the nested lower-dimensional splines.
+   */
+  void value_batch( const int n,
+                    const double * const * indepVars,
+                    double * result,
+                    BSplineBatch & work ) const;
+
+  /** The 1-D spline carrying the knots of dimension d (batch support) */
+  virtual const BSpline1D & axis( const int d ) const = 0;
+
+  /**
+   *  Tensor contraction for point k of a prepared batch, where this spline
+   *  spans dimensions d through d+dim-1 (batch support)
+   */
+  virtual double contract( const int k,
+                           const int d,
+                           const BSplineBatch & work ) const = 0;
+
   /**
    *  Read a spline from an HDF5 database.  The file should be opened
    *  and an hdf5 "group" specified.  This spline will be read from the
@@ -132,6 +180,9 @@ class BSpline1D : public BSpline{
   double value( const double* indepVar ) const;
   inline double value( const double & x ) const{ return value(&x); }
 
+  const BSpline1D & axis( const int ) const{ return *this; }
+  double contract( const int k, const int d, const BSplineBatch & work ) const;
+
   inline const std::vector<double> & get_control_pts() const{ return controlPts_; }
   inline       std::vector<double> & get_control_pts()      { return controlPts_; }
   inline const std::vector<double> & get_knot_vector() const{ return knots_; };
@@ -233,6 +284,9 @@ class BSpline2D : public BSpline{
    */
   double value( const double* indepVar ) const;
 
+  const BSpline1D & axis( const int d ) const;
+  double contract( const int k, const int d, const BSplineBatch & work ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
@@ -317,6 +371,9 @@ class BSpline3D : public BSpline{
    */
   double value( const double* ) const;
 
+  const BSpline1D & axis( const int d ) const;
+  double contract( const int k, const int d, const BSplineBatch & work ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
@@ -405,6 +462,9 @@ class BSpline4D : public BSpline{
    */
   double value( const double* x ) const;
 
+  const BSpline1D & axis( const int d ) const;
+  double contract( const int k, const int d, const BSplineBatch & work ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
@@ -496,6 +556,9 @@ class BSpline5D : public BSpline{
    */
   double value( const double* x ) const;
 
+  const BSpline1D & axis( const int d ) const;
+  double contract( const int k, const int d, const BSplineBatch & work ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
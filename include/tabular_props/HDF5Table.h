@@ -16,6 +16,8 @@ namespace nalu {
 class Converter;
 class H5IO;
 class BSpline;
+struct BSplineBatch;
+class UniformGridTable;
 
 struct ClipEvent {
   double severity;
@@ -106,6 +108,37 @@ class HDF5Table
    */
   double raw_query( const std::vector<double> &inputs ) const;
 
+  /**
+   *  Evaluate the property at n points.  Identical to query() point by
+   *  point, including clipping and logging, but the table is interpolated
+   *  for all points at once.
+   *
+   *  @param n      : Number of points
+   *  @param inputs : inputs[i] points to the n values of input variable i
+   *  @param result : The n property values
+   *  @param work   : Caller-owned scratch space, reused between calls
+   */
+  void query_batch( const int n,
+                    const double * const * inputs,
+                    double * result,
+                    BSplineBatch & work ) const;
+
+  /**
+   *  Replace spline evaluation in query() and query_batch() with a
+   *  uniform-grid resampling of the spline (see UniformGridTable).
+   *  raw_query() still uses the spline so that extrapolation is unchanged.
+   *
+   *  @param tolerance : maximum interpolation error relative to the value range
+   *  @param cubic     : cubic Hermite rather than multilinear interpolation
+   *  @param maxPoints : upper bound on the number of grid points
+   */
+  void enable_uniform_grid( const double tolerance,
+                            const bool cubic,
+                            const size_t maxPoints );
+
+  /** The uniform grid in use, or NULL if queries go to the spline */
+  const UniformGridTable * uniform_grid() const { return grid_; }
+
   /** Set the number of clipping events we want to log */
   void set_clipping_log_size( unsigned int size ) ;
 
@@ -228,6 +261,9 @@ class HDF5Table
   // Internal interpolator used to perform table lookups
   BSpline * spline_;
 
+  // Optional uniform-grid resampling of spline_
+  UniformGridTable * grid_;
+
   // Buffers for storing clipping diagnostic information
   mutable unsigned int clipEventLogSize_;
   mutable unsigned int numClipped_;
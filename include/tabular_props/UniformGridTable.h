@@ -0,0 +1,106 @@
+#ifndef UNIFORMGRIDTABLE_H
+#define UNIFORMGRIDTABLE_H
+
+#include <vector>
+#include <cstddef>
+
+namespace sierra {
+namespace nalu {
+
+// Forward declarations
+class BSpline;
+
+//====================================================================
+//====================================================================
+
+/**
+ *  @class  UniformGridTable
+ *  @brief  Uniform-grid resampling of a BSpline for fast lookups
+ *
+ *  The spline is sampled on a uniform grid spanning its knot range in
+ *  each dimension.  The grid lives in the spline's own coordinates, so
+ *  table inputs that are log-scaled before reaching the spline are
+ *  sampled uniformly in log space.  Queries locate the cell by direct
+ *  indexing and interpolate either multilinearly or with cubic Hermite
+ *  (Catmull-Rom) polynomials.
+ *
+ *  The grid is built at construction time.  Starting from the number of
+ *  spline control points in each dimension, the grid spacing is halved
+ *  until the maximum deviation from the spline, measured at a fixed set
+ *  of quasi-random points, drops below the tolerance or the grid would
+ *  exceed maxPoints.  A first grid larger than maxPoints is coarsened
+ *  before it is sampled.  The tolerance is relative to the range of the
+ *  sampled values.
+ */
+class UniformGridTable{
+ public:
+
+  UniformGridTable( const BSpline & spline,
+                    const double tolerance,
+                    const bool cubic,
+                    const size_t maxPoints );
+
+  ~UniformGridTable();
+
+  /** Interpolate at a point given in spline coordinates */
+  double value( const double* x ) const;
+
+  /** Interpolate at n points; x[d] points to the n values of dimension d */
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result ) const;
+
+  /** Maximum deviation from the spline at the test points (relative to the value range) */
+  double max_error() const{ return maxError_; }
+
+  /** true if max_error() is within the requested tolerance */
+  bool converged() const{ return maxError_ <= tolerance_; }
+
+  /** Number of grid points in dimension d */
+  int get_npts( const int d ) const{ return npts_[d]; }
+
+  /** Total number of grid points */
+  size_t size() const{ return values_.size(); }
+
+  /** Storage used by the grid, in bytes */
+  size_t memory_bytes() const;
+
+  bool is_cubic() const{ return cubic_; }
+
+ private:
+
+  enum { MAX_DIM = 5 };
+
+  UniformGridTable( const UniformGridTable & );
+  UniformGridTable & operator=( const UniformGridTable & );
+
+  // sample the spline on a grid with the given number of points per dimension
+  void build( const BSpline & spline, const std::vector<int> & npts );
+
+  // maximum |grid - spline| at n test points with spline values f
+  double sample_error( const int n,
+                       const double * const * x,
+                       const double * f ) const;
+
+  const int dim_;
+  const double tolerance_;
+  const bool cubic_;
+
+  double lo_[MAX_DIM];
+  double hi_[MAX_DIM];
+  double invDx_[MAX_DIM];
+  int npts_[MAX_DIM];
+  size_t stride_[MAX_DIM];
+
+  // grid values, first dimension varying slowest
+  std::vector<double> values_;
+
+  // value range of the grid, used to normalize the error
+  double valueRange_;
+  double maxError_;
+};
+
+} // end nalu namespace
+} // end sierra namespace
+
+#endif
@@ -47,6 +47,10 @@ public :
   static void apply (MeshB         &ToPoints,
       const MeshA         &FromElem,
       const EntityKeyMap &RangeToDomain) ;
+
+  static void build_interpolation_operator (MeshB         &ToPoints,
+      const MeshA         &FromElem,
+      const EntityKeyMap &RangeToDomain) ;
 };
 
 template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
@@ -67,6 +71,9 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   typedef typename EntityKeyMap::iterator iterator;
   typedef typename EntityKeyMap::const_iterator const_iterator;
 
+  // new search; the interpolation operator must be rebuilt
+  ToPoints.xferCacheValid_ = false;
+
   for (const_iterator current_key=RangeToDomain.begin(); current_key!=RangeToDomain.end(); ) { 
 
     double bestX_ = std::numeric_limits<double>::max();
@@ -129,10 +136,61 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
         const MeshA        &FromElem,
         const EntityKeyMap &RangeToDomain) {
   
+  const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
+  const stk::mesh::BulkData &toBulkData = ToPoints.toBulkData_;
+
+  // search results are fixed between searches; any mesh modification forces a rebuild
+  if ( !ToPoints.xferCacheValid_ 
+       || ToPoints.xferFromSyncCount_ != fromBulkData.synchronized_count()
+       || ToPoints.xferToSyncCount_ != toBulkData.synchronized_count() )
+    build_interpolation_operator(ToPoints, FromElem, RangeToDomain);
+
+  const size_t numPoints = ToPoints.xferToNode_.size();
+
+  for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
+
+    const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
+    const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+
+    // sparse mat-vec over the cached weights
+    for ( size_t p = 0; p < numPoints; ++p ) {
+      stk::mesh::Entity theNode = ToPoints.xferToNode_[p];
+
+      // FixMe: integers are problematic for now...
+      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
+
+      double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
+      if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
+      for ( size_t j = 0; j < sizeOfField; ++j )
+        toField[j] = 0.0;
+
+      for ( size_t k = ToPoints.xferOffset_[p]; k < ToPoints.xferOffset_[p+1]; ++k ) {
+        const double w = ToPoints.xferWeight_[k];
+        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, ToPoints.xferFromNode_[k]);
+        for ( size_t j = 0; j < sizeOfField; ++j )
+          toField[j] += w*theField[j];
+      }
+    }
+  }
+}
+
+template <class FROM, class TO>  void LinInterp<FROM,TO>::build_interpolation_operator 
+       (MeshB              &ToPoints,
+        const MeshA        &FromElem,
+        const EntityKeyMap &RangeToDomain) {
+  
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
   Realm &fromRealm = FromElem.fromRealm_;
 
+  ToPoints.xferToNode_.clear();
+  ToPoints.xferOffset_.assign(1, 0);
+  ToPoints.xferFromNode_.clear();
+  ToPoints.xferWeight_.clear();
+
+  std::vector<double> identity;
+  std::vector<double> weights;
+
   typename EntityKeyMap::const_iterator ii;
   for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
     
@@ -157,36 +215,27 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
     const int num_nodes = fromBulkData.num_nodes(theElem);
     const int nodesPerElement = meSCS->nodesPerElement_;
 
-    for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
-
-      // extract field
-      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
-
-      // FixMe: integers are problematic for now...
-      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
-
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
-
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
-
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
-
-      double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
-      if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
-    }   
+    // interpolating the identity provides the weight of each element node
+    identity.assign(nodesPerElement*nodesPerElement, 0.0);
+    for ( int ni = 0; ni < nodesPerElement; ++ni )
+      identity[ni*nodesPerElement + ni] = 1.0;
+    weights.resize(nodesPerElement);
+    meSCS->interpolatePoint(nodesPerElement,
+                            &isoParCoords_[0],
+                            &identity[0],
+                            &weights[0]);
+
+    ToPoints.xferToNode_.push_back(theNode);
+    for ( int ni = 0; ni < num_nodes; ++ni ) { 
+      ToPoints.xferFromNode_.push_back(elem_node_rels[ni]);
+      ToPoints.xferWeight_.push_back(weights[ni]);
+    }
+    ToPoints.xferOffset_.push_back(ToPoints.xferFromNode_.size());
   }
+
+  ToPoints.xferFromSyncCount_ = fromBulkData.synchronized_count();
+  ToPoints.xferToSyncCount_ = toBulkData.synchronized_count();
+  ToPoints.xferCacheValid_ = true;
 }
 
 } // namespace nalu
@@ -0,0 +1,122 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PointRedistribution_h
+#define PointRedistribution_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_search/SearchMethod.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Part;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// PointRedistribution
+//=============================================================================
+/**
+ * * @par Description:
+ * - nodal transfer between realms that live on disjoint communicators. The
+ *   owned target nodes travel over the union communicator to every process
+ *   whose donor bounding box contains them; that process finds the nearest
+ *   element with the master element and sends back interpolated values.
+ *   Each target node keeps the donor process that reported the smallest
+ *   distance.
+ *
+ * @par Design Considerations:
+ * - every call is collective on the union communicator, including processes
+ *   that hold neither realm. Donor choice and interpolation weights are kept
+ *   until either mesh changes its synchronized count.
+ */
+//=============================================================================
+class PointRedistribution
+{
+public:
+
+  typedef std::vector<std::pair<std::string, std::string> > PairNames;
+
+  PointRedistribution(
+    Realm &fromRealm,
+    Realm &toRealm,
+    const stk::mesh::Part *fromPart,
+    const stk::mesh::Part *toPart,
+    const PairNames &varPairName,
+    const stk::search::SearchMethod searchMethod,
+    stk::ParallelMachine comm);
+  ~PointRedistribution();
+
+  // search and donor selection; collective
+  void initialize();
+
+  // interpolate and ship the transfer variables; collective
+  void apply();
+
+private:
+
+  // donor elements of this process and the padded box around them
+  void gather_donors(
+    std::vector<stk::mesh::Entity> &donorElem,
+    std::vector<double> &donorBox,
+    double *procBox);
+
+  // nearest donor element for every received point
+  void find_donors(
+    const std::vector<stk::mesh::Entity> &donorElem,
+    const std::vector<double> &donorBox,
+    const std::vector<double> &recvCoords,
+    const std::vector<size_t> &recvBegin,
+    std::vector<double> &distance);
+
+  Realm &fromRealm_;
+  Realm &toRealm_;
+  const stk::mesh::Part *fromPart_;
+  const stk::mesh::Part *toPart_;
+  const stk::search::SearchMethod searchMethod_;
+  stk::ParallelMachine comm_;
+  const bool fromActive_;
+  const bool toActive_;
+
+  std::vector<const stk::mesh::FieldBase *> fromFieldVec_;
+  std::vector<const stk::mesh::FieldBase *> toFieldVec_;
+
+  // target side; owned nodes, the winning donor process (-1 when none) and,
+  // per process, the node indices in the order they were shipped
+  std::vector<stk::mesh::Entity> toNode_;
+  std::vector<int> donorProc_;
+  std::vector<std::vector<size_t> > sentNode_;
+
+  // donor side; per requesting process, point p gathers donorWeight_ *
+  // donorNode_ over [donorOffset_[p], donorOffset_[p+1])
+  std::vector<std::vector<size_t> > donorOffset_;
+  std::vector<std::vector<stk::mesh::Entity> > donorNode_;
+  std::vector<std::vector<double> > donorWeight_;
+
+  bool initialized_;
+  size_t fromSyncCount_;
+  size_t toSyncCount_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
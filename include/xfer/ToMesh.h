@@ -69,7 +69,10 @@ public :
     toFieldVec_   (get_fields(toMetaData, VarPairName)),
     toMeshPart_(toMeshPart),
     comm_(comm),
-    radius_(radius)   {}
+    radius_(radius),
+    xferCacheValid_(false),
+    xferFromSyncCount_(0),
+    xferToSyncCount_(0)   {}
 
   ~ToMesh(){};
 
@@ -138,6 +141,16 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // sparse interpolation operator built from TransferInfo_ on first apply;
+  // point p gathers xferWeight_ * from nodes over [xferOffset_[p], xferOffset_[p+1])
+  bool xferCacheValid_;
+  size_t xferFromSyncCount_;
+  size_t xferToSyncCount_;
+  std::vector<stk::mesh::Entity> xferToNode_;
+  std::vector<size_t> xferOffset_;
+  std::vector<stk::mesh::Entity> xferFromNode_;
+  std::vector<double> xferWeight_;
+
 };
 
 } // namespace nalu
@@ -30,6 +30,7 @@ class Part;
 namespace sierra{
 namespace nalu{
 
+class PointRedistribution;
 class Realm;
 class Transfers;
 class Simulation;
@@ -55,6 +56,9 @@ public:
   Transfers &transfers_;
   boost::shared_ptr<stk::transfer::TransferBase> transfer_;
 
+  // realms on disjoint communicators are coupled by point redistribution
+  boost::shared_ptr<PointRedistribution> redistribution_;
+
   bool couplingPhysicsSpecified_;
   bool transferVariablesSpecified_;
   std::string couplingPhysicsName_;
@@ -74,6 +78,7 @@ public:
   std::pair<const stk::mesh::Part *, const stk::mesh::Part *> meshPartPair_;
 
   void allocate_stk_transfer();
+  void allocate_redistribution();
   void ghost_from_elements();
 };
 
@@ -39,6 +39,7 @@ public:
   void load(const YAML::Node & node);
   void breadboard();
   void initialize();
+  void execute();
   Simulation *root();
   Simulation *parent();
 